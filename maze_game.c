@@ -12,7 +12,9 @@
 ********************************************************************************************/
 
 #include "raylib.h"
+#include "raymath.h"    // Required for: Vector3Add(), MatrixIdentity()
 #include <stdlib.h>     // Required for: malloc(), free()
+#include <math.h>       // Required for: fabsf()
 #include <time.h>
 
 #define MAZE_WIDTH          64
@@ -20,16 +22,89 @@
 #define MAZE_SCALE          10.0f
 #define MAX_MAZE_ITEMS      16
 
+// Maze 3d model, split in chunks so an edited cell only rebuilds its chunk
+#define MAZE_CHUNK_SIZE     16
+#define MAZE_CHUNKS_X       ((MAZE_WIDTH + MAZE_CHUNK_SIZE - 1)/MAZE_CHUNK_SIZE)
+#define MAZE_CHUNKS_Y       ((MAZE_HEIGHT + MAZE_CHUNK_SIZE - 1)/MAZE_CHUNK_SIZE)
+#define MAZE_WALL_HEIGHT    1.0f
+#define MAZE_STATS_ITERATIONS   20  // Mesh builds averaged for greedy vs naive stats
+
+// Biome atlas tiles (2x2 grid of 128x128 tiles), same layout used by 2d drawing
+#define MAZE_TILE_WALL_OUTER    0   // top-left
+#define MAZE_TILE_WALL_INNER    2   // bottom-left
+#define MAZE_TILE_FLOOR         3   // bottom-right
+
 // Declare new data type: Point
 typedef struct Point {
     int x;
     int y;
 } Point;
 
+// Maze mesh generation statistics: greedy vs naive (one cube per wall cell)
+typedef struct MazeMeshStats {
+    int greedyVertexCount;
+    int greedyTriangleCount;
+    double greedyBuildTime;     // Full maze build time, in milliseconds
+    int naiveVertexCount;
+    int naiveTriangleCount;
+    double naiveBuildTime;      // Full maze build time, in milliseconds
+} MazeMeshStats;
+
+// Maze atlas shader: repeats texcoords inside the atlas tile provided by texcoords2,
+// required because greedy-merged quads span several cells of the same tile
+static const char *mazeAtlasVsCode =
+    "#version 330\n"
+    "in vec3 vertexPosition;\n"
+    "in vec2 vertexTexCoord;\n"
+    "in vec2 vertexTexCoord2;\n"
+    "in vec3 vertexNormal;\n"
+    "uniform mat4 mvp;\n"
+    "out vec2 fragTexCoord;\n"
+    "out vec2 fragTileOrigin;\n"
+    "out vec3 fragNormal;\n"
+    "void main()\n"
+    "{\n"
+    "    fragTexCoord = vertexTexCoord;\n"
+    "    fragTileOrigin = vertexTexCoord2;\n"
+    "    fragNormal = vertexNormal;\n"
+    "    gl_Position = mvp*vec4(vertexPosition, 1.0);\n"
+    "}\n";
+
+static const char *mazeAtlasFsCode =
+    "#version 330\n"
+    "in vec2 fragTexCoord;\n"
+    "in vec2 fragTileOrigin;\n"
+    "in vec3 fragNormal;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "out vec4 finalColor;\n"
+    "void main()\n"
+    "{\n"
+    "    vec2 uv = fragTileOrigin + fract(fragTexCoord)*0.5;\n"
+    "    float light = 0.6 + 0.4*max(dot(normalize(fragNormal), normalize(vec3(0.4, 1.0, 0.6))), 0.0);\n"
+    "    finalColor = texture(texture0, uv)*colDiffuse*vec4(vec3(light), 1.0);\n"
+    "}\n";
+
 // Generate procedural maze image, using grid-based algorithm
 // NOTE: Functions defined as static are internal to the module
 static Image GenImageMaze(int width, int height, int spacingRows, int spacingCols, float pointChance);
 
+// Generate maze 3d mesh for a region of cells, merging coplanar faces into large quads
+// NOTE: Mesh is generated on CPU, it must be uploaded with UploadMesh() to be drawn
+static Mesh GenMeshMazeGreedy(Image imMaze, int cellX, int cellY, int width, int height);
+
+// Generate maze 3d mesh for a region of cells, one cube per wall cell (reference for stats)
+static Mesh GenMeshMazeNaive(Image imMaze, int cellX, int cellY, int width, int height);
+
+// Get full maze mesh vertex/triangle counts and build times, greedy vs naive (CPU only)
+static MazeMeshStats GetMazeMeshStats(Image imMaze);
+
+// Rebuild one maze model chunk mesh and upload it to GPU
+static void ReloadMazeChunk(Mesh *chunks, Image imMaze, int chunkX, int chunkY);
+
+// Rebuild maze model chunk meshes affected by an edited cell
+static void UpdateMazeChunks(Mesh *chunks, Image imMaze, int cellX, int cellY);
+
 //----------------------------------------------------------------------------------
 // Main entry point
 //----------------------------------------------------------------------------------
@@ -45,7 +120,7 @@ int main(void)
     InitWindow(screenWidth, screenHeight, "Delivery04 - maze game");
 
     // Current application mode
-    int currentMode = 1;    // 0-Game, 1-Editor
+    int currentMode = 1;    // 0-Game, 1-Editor, 2-3D view
 
     // Random seed defines the random numbers generation,
     // always the same if using the same seed
@@ -98,6 +173,28 @@ int main(void)
     // TODO: Load additional textures for different biomes
     int currentBiome = 0;
 
+    // Maze 3d model: greedy-meshed chunks drawn with the current biome atlas
+    Mesh mazeChunks[MAZE_CHUNKS_X*MAZE_CHUNKS_Y] = { 0 };
+    for (int y = 0; y < MAZE_CHUNKS_Y; y++)
+    {
+        for (int x = 0; x < MAZE_CHUNKS_X; x++) ReloadMazeChunk(mazeChunks, imMaze, x, y);
+    }
+
+    Shader shdMazeAtlas = LoadShaderFromMemory(mazeAtlasVsCode, mazeAtlasFsCode);
+    Material matMaze = LoadMaterialDefault();
+    matMaze.shader = shdMazeAtlas;
+
+    // Compare greedy mesh against one cube per wall cell
+    MazeMeshStats mazeMeshStats = GetMazeMeshStats(imMaze);
+
+    // Camera 3D for maze model view mode
+    Camera3D camera3d = { 0 };
+    camera3d.position = (Vector3){ MAZE_WIDTH/2.0f, MAZE_WIDTH*0.75f, MAZE_HEIGHT*1.25f };
+    camera3d.target = (Vector3){ MAZE_WIDTH/2.0f, 0.0f, MAZE_HEIGHT/2.0f };
+    camera3d.up = (Vector3){ 0.0f, 1.0f, 0.0f };
+    camera3d.fovy = 45.0f;
+    camera3d.projection = CAMERA_PERSPECTIVE;
+
     // TODO: Define all variables required for game UI elements (sprites, fonts...)
 
     SetTargetFPS(60);       // Set our game to run at 60 frames-per-second
@@ -110,6 +207,7 @@ int main(void)
         //----------------------------------------------------------------------------------
         // Select current mode as desired
         if (IsKeyPressed(KEY_SPACE)) currentMode = !currentMode; // Toggle mode: 0-Game, 1-Editor
+        if (IsKeyPressed(KEY_TAB)) currentMode = (currentMode == 2)? 1 : 2; // Toggle mode: 2-3D view
         
         // Teclas para cambiar bioma (1, 2, 3, 4)
         if (IsKeyPressed(KEY_ONE)) currentBiome = 0;
@@ -233,6 +331,7 @@ int main(void)
             if ((cellX >= 0) && (cellX < MAZE_WIDTH) &&
                 (cellY >= 0) && (cellY < MAZE_HEIGHT))
             {
+                bool wasWall = ColorIsEqual(GetImageColor(imMaze, cellX, cellY), WHITE);
 
                 // BOTÓN IZQUIERDO: BLACK (camino)
                 if (IsMouseButtonDown(MOUSE_BUTTON_LEFT))
@@ -288,16 +387,27 @@ int main(void)
                         UpdateTexture(texMaze, imMaze.data);
                     }
                 }
+
+                // Only wall changes modify the 3d model, rebuild affected chunks
+                if (ColorIsEqual(GetImageColor(imMaze, cellX, cellY), WHITE) != wasWall)
+                {
+                    UpdateMazeChunks(mazeChunks, imMaze, cellX, cellY);
+                }
             }
 
             // TODO: [2p] Collectible map items: player score
             // Using same mechanism than maze editor, implement an items editor, registering
             // points in the map where items should be added for player pickup -> TIP: Use mazeItems[]
         }
+        else if (currentMode == 2) // 3D view mode
+        {
+            UpdateCamera(&camera3d, CAMERA_ORBITAL);
+        }
 
         // TODO: [1p] Multiple maze biomes supported
         // Implement changing between the different textures to be used as biomes
         // NOTE: For the 3d model, the current selected texture must be applied to the model material  
+        matMaze.maps[MATERIAL_MAP_DIFFUSE].texture = texBiomes[currentBiome];
 
         //----------------------------------------------------------------------------------
 
@@ -506,6 +616,32 @@ int main(void)
                 DrawText("Right = WHITE", 10, 100, 20, DARKGRAY);
                 DrawText("Right+Ctrl = GREEN", 10, 120, 20, DARKGRAY);
             }
+            else if (currentMode == 2) // 3D view mode
+            {
+                BeginMode3D(camera3d);
+
+                    for (int i = 0; i < MAZE_CHUNKS_X*MAZE_CHUNKS_Y; i++)
+                    {
+                        if (mazeChunks[i].vertexCount > 0) DrawMesh(mazeChunks[i], matMaze, MatrixIdentity());
+                    }
+
+                EndMode3D();
+
+                int modelVertexCount = 0;
+                int modelTriangleCount = 0;
+                for (int i = 0; i < MAZE_CHUNKS_X*MAZE_CHUNKS_Y; i++)
+                {
+                    modelVertexCount += mazeChunks[i].vertexCount;
+                    modelTriangleCount += mazeChunks[i].triangleCount;
+                }
+
+                DrawText("3D VIEW MODE", 10, 40, 20, DARKGRAY);
+                DrawText(TextFormat("MODEL: %i vertices, %i triangles", modelVertexCount, modelTriangleCount), 10, 60, 20, DARKGRAY);
+                DrawText(TextFormat("GREEDY: %i vertices, %i triangles, %.3f ms", mazeMeshStats.greedyVertexCount,
+                    mazeMeshStats.greedyTriangleCount, mazeMeshStats.greedyBuildTime), 10, 80, 20, DARKGRAY);
+                DrawText(TextFormat("NAIVE: %i vertices, %i triangles, %.3f ms", mazeMeshStats.naiveVertexCount,
+                    mazeMeshStats.naiveTriangleCount, mazeMeshStats.naiveBuildTime), 10, 100, 20, DARKGRAY);
+            }
 
             DrawFPS(10, 10);
 
@@ -523,6 +659,10 @@ int main(void)
     UnloadTexture(texBiomes[1]);
     UnloadTexture(texBiomes[2]);
     UnloadTexture(texBiomes[3]); 
+
+    for (int i = 0; i < MAZE_CHUNKS_X*MAZE_CHUNKS_Y; i++) UnloadMesh(mazeChunks[i]);
+    UnloadShader(shdMazeAtlas);
+    MemFree(matMaze.maps);      // Material shader/textures are shared, only maps array is owned
     
     CloseWindow();              // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
@@ -660,4 +800,334 @@ static Image GenImageMaze(int width, int height, int spacingRows, int spacingCol
     
     // Retornar la imagen resultante
     return imMaze;
-}
\ No newline at end of file
+}
+
+// Check if maze cell is a wall, cells out of the maze are considered empty
+static bool IsMazeWall(Image imMaze, int x, int y)
+{
+    if ((x < 0) || (x >= imMaze.width) || (y < 0) || (y >= imMaze.height)) return false;
+
+    return ColorIsEqual(GetImageColor(imMaze, x, y), WHITE);
+}
+
+// Get biome atlas tile for a maze cell, matching 2d drawing: outer walls, inner walls and floor
+static int GetMazeCellTile(Image imMaze, int x, int y)
+{
+    if (!IsMazeWall(imMaze, x, y)) return MAZE_TILE_FLOOR;
+
+    if ((x == 0) || (y == 0) || (x == imMaze.width - 1) || (y == imMaze.height - 1)) return MAZE_TILE_WALL_OUTER;
+    else return MAZE_TILE_WALL_INNER;
+}
+
+// Get biome atlas tile for a maze cell side face looking to (dx, dy), -1 if face is hidden
+static int GetMazeSideTile(Image imMaze, int x, int y, int dx, int dy)
+{
+    if (!IsMazeWall(imMaze, x, y) || IsMazeWall(imMaze, x + dx, y + dy)) return -1;
+
+    return GetMazeCellTile(imMaze, x, y);
+}
+
+// Allocate maze mesh data for a maximum number of quads, counts start at 0
+static Mesh AllocMazeMesh(int maxQuads)
+{
+    Mesh mesh = { 0 };
+    mesh.vertices = (float *)MemAlloc(maxQuads*4*3*sizeof(float));
+    mesh.texcoords = (float *)MemAlloc(maxQuads*4*2*sizeof(float));
+    mesh.texcoords2 = (float *)MemAlloc(maxQuads*4*2*sizeof(float));
+    mesh.normals = (float *)MemAlloc(maxQuads*4*3*sizeof(float));
+    mesh.indices = (unsigned short *)MemAlloc(maxQuads*6*sizeof(unsigned short));
+
+    return mesh;
+}
+
+// Shrink maze mesh data to the generated vertex/triangle counts
+static void ShrinkMazeMesh(Mesh *mesh)
+{
+    int vertexCount = (mesh->vertexCount > 0)? mesh->vertexCount : 1;
+    int triangleCount = (mesh->triangleCount > 0)? mesh->triangleCount : 1;
+
+    mesh->vertices = (float *)MemRealloc(mesh->vertices, vertexCount*3*sizeof(float));
+    mesh->texcoords = (float *)MemRealloc(mesh->texcoords, vertexCount*2*sizeof(float));
+    mesh->texcoords2 = (float *)MemRealloc(mesh->texcoords2, vertexCount*2*sizeof(float));
+    mesh->normals = (float *)MemRealloc(mesh->normals, vertexCount*3*sizeof(float));
+    mesh->indices = (unsigned short *)MemRealloc(mesh->indices, triangleCount*3*sizeof(unsigned short));
+}
+
+// Free maze mesh data generated on CPU (not uploaded to GPU)
+static void UnloadMazeMeshData(Mesh mesh)
+{
+    MemFree(mesh.vertices);
+    MemFree(mesh.texcoords);
+    MemFree(mesh.texcoords2);
+    MemFree(mesh.normals);
+    MemFree(mesh.indices);
+}
+
+// Add quad to maze mesh, origin is the top-left corner as seen from the normal side
+// NOTE: Quad must be axis-aligned, texcoords are in cell units (repeated by the atlas shader)
+// and texcoords2 store the atlas tile origin
+static void MeshAddQuad(Mesh *mesh, Vector3 origin, Vector3 right, Vector3 down, Vector3 normal, int tile)
+{
+    Vector3 corners[4] = {
+        origin,
+        Vector3Add(origin, down),
+        Vector3Add(Vector3Add(origin, down), right),
+        Vector3Add(origin, right)
+    };
+
+    float uLength = fabsf(right.x + right.y + right.z);
+    float vLength = fabsf(down.x + down.y + down.z);
+    Vector2 texcoords[4] = { { 0.0f, 0.0f }, { 0.0f, vLength }, { uLength, vLength }, { uLength, 0.0f } };
+    Vector2 tileOrigin = { (tile%2)*0.5f, (tile/2)*0.5f };
+
+    int v = mesh->vertexCount;
+    for (int i = 0; i < 4; i++)
+    {
+        mesh->vertices[(v + i)*3 + 0] = corners[i].x;
+        mesh->vertices[(v + i)*3 + 1] = corners[i].y;
+        mesh->vertices[(v + i)*3 + 2] = corners[i].z;
+        mesh->texcoords[(v + i)*2 + 0] = texcoords[i].x;
+        mesh->texcoords[(v + i)*2 + 1] = texcoords[i].y;
+        mesh->texcoords2[(v + i)*2 + 0] = tileOrigin.x;
+        mesh->texcoords2[(v + i)*2 + 1] = tileOrigin.y;
+        mesh->normals[(v + i)*3 + 0] = normal.x;
+        mesh->normals[(v + i)*3 + 1] = normal.y;
+        mesh->normals[(v + i)*3 + 2] = normal.z;
+    }
+
+    // Counter-clockwise triangles: (0, 1, 2) and (0, 2, 3)
+    int t = mesh->triangleCount*3;
+    mesh->indices[t + 0] = (unsigned short)(v + 0);
+    mesh->indices[t + 1] = (unsigned short)(v + 1);
+    mesh->indices[t + 2] = (unsigned short)(v + 2);
+    mesh->indices[t + 3] = (unsigned short)(v + 0);
+    mesh->indices[t + 4] = (unsigned short)(v + 2);
+    mesh->indices[t + 5] = (unsigned short)(v + 3);
+
+    mesh->vertexCount += 4;
+    mesh->triangleCount += 2;
+}
+
+// Add maze wall side quad for a run of cells starting at (x, y), looking to (dx, dy)
+static void MeshAddMazeSide(Mesh *mesh, int x, int y, int dx, int dy, int length, int tile)
+{
+    Vector3 origin = { 0 };
+    Vector3 right = { 0 };
+    Vector3 down = { 0.0f, -MAZE_WALL_HEIGHT, 0.0f };
+    Vector3 normal = { (float)dx, 0.0f, (float)dy };
+
+    if (dx > 0)      { origin = (Vector3){ x + 1.0f, MAZE_WALL_HEIGHT, (float)(y + length) }; right = (Vector3){ 0.0f, 0.0f, (float)-length }; }
+    else if (dx < 0) { origin = (Vector3){ (float)x, MAZE_WALL_HEIGHT, (float)y }; right = (Vector3){ 0.0f, 0.0f, (float)length }; }
+    else if (dy > 0) { origin = (Vector3){ (float)x, MAZE_WALL_HEIGHT, y + 1.0f }; right = (Vector3){ (float)length, 0.0f, 0.0f }; }
+    else             { origin = (Vector3){ (float)(x + length), MAZE_WALL_HEIGHT, (float)y }; right = (Vector3){ (float)-length, 0.0f, 0.0f }; }
+
+    MeshAddQuad(mesh, origin, right, down, normal, tile);
+}
+
+// Generate maze 3d mesh for a region of cells, merging coplanar faces into large quads
+// NOTE: Walls bottom faces, floor under walls and sides between two walls are never visible,
+// so they are not generated; maze borders are considered open so outer sides are generated
+static Mesh GenMeshMazeGreedy(Image imMaze, int cellX, int cellY, int width, int height)
+{
+    // Max quads per cell: top or floor + 4 sides
+    Mesh mesh = AllocMazeMesh(width*height*5);
+    int *mask = (int *)malloc(width*height*sizeof(int));
+
+    // 1) Horizontal faces: floor (layer 0) and walls top (layer 1), merged into rectangles
+    for (int layer = 0; layer < 2; layer++)
+    {
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                bool wall = IsMazeWall(imMaze, cellX + x, cellY + y);
+                mask[y*width + x] = (wall == (layer == 1))? GetMazeCellTile(imMaze, cellX + x, cellY + y) : -1;
+            }
+        }
+
+        for (int y = 0; y < height; y++)
+        {
+            for (int x = 0; x < width; x++)
+            {
+                int tile = mask[y*width + x];
+                if (tile < 0) continue;
+
+                // Grow rectangle width along the row, then height while full rows match
+                int w = 1;
+                while (((x + w) < width) && (mask[y*width + x + w] == tile)) w++;
+
+                int h = 1;
+                while ((y + h) < height)
+                {
+                    bool rowMatch = true;
+                    for (int k = 0; k < w; k++)
+                    {
+                        if (mask[(y + h)*width + x + k] != tile) { rowMatch = false; break; }
+                    }
+
+                    if (!rowMatch) break;
+                    h++;
+                }
+
+                for (int j = 0; j < h; j++)
+                {
+                    for (int k = 0; k < w; k++) mask[(y + j)*width + x + k] = -1;
+                }
+
+                Vector3 origin = { (float)(cellX + x), layer*MAZE_WALL_HEIGHT, (float)(cellY + y) };
+                MeshAddQuad(&mesh, origin, (Vector3){ (float)w, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, (float)h }, (Vector3){ 0.0f, 1.0f, 0.0f }, tile);
+            }
+        }
+    }
+
+    free(mask);
+
+    // 2) Vertical faces: wall sides facing a non-wall cell, merged into runs along the wall line
+    //    NOTE: Neighbour cells out of the region are checked in the image, chunks borders match
+    int sides[4][2] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+
+    for (int s = 0; s < 4; s++)
+    {
+        int dx = sides[s][0];
+        int dy = sides[s][1];
+        bool alongX = (dy != 0);     // Faces looking to Y are merged along X, and vice versa
+        int lineCount = alongX? height : width;
+        int lineLength = alongX? width : height;
+
+        for (int l = 0; l < lineCount; l++)
+        {
+            for (int i = 0; i < lineLength; )
+            {
+                int x = cellX + (alongX? i : l);
+                int y = cellY + (alongX? l : i);
+                int tile = GetMazeSideTile(imMaze, x, y, dx, dy);
+                if (tile < 0) { i++; continue; }
+
+                int length = 1;
+                while (((i + length) < lineLength) &&
+                       (GetMazeSideTile(imMaze, x + (alongX? length : 0), y + (alongX? 0 : length), dx, dy) == tile)) length++;
+
+                MeshAddMazeSide(&mesh, x, y, dx, dy, length, tile);
+                i += length;
+            }
+        }
+    }
+
+    ShrinkMazeMesh(&mesh);
+
+    return mesh;
+}
+
+// Generate maze 3d mesh for a region of cells, one cube per wall cell and one quad per floor cell
+static Mesh GenMeshMazeNaive(Image imMaze, int cellX, int cellY, int width, int height)
+{
+    // Max quads per cell: cube 6 faces
+    Mesh mesh = AllocMazeMesh(width*height*6);
+
+    for (int y = cellY; y < cellY + height; y++)
+    {
+        for (int x = cellX; x < cellX + width; x++)
+        {
+            int tile = GetMazeCellTile(imMaze, x, y);
+
+            if (IsMazeWall(imMaze, x, y))
+            {
+                MeshAddQuad(&mesh, (Vector3){ (float)x, MAZE_WALL_HEIGHT, (float)y }, (Vector3){ 1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, tile);
+                MeshAddQuad(&mesh, (Vector3){ (float)x, 0.0f, y + 1.0f }, (Vector3){ 1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, -1.0f }, (Vector3){ 0.0f, -1.0f, 0.0f }, tile);
+                MeshAddMazeSide(&mesh, x, y, 1, 0, 1, tile);
+                MeshAddMazeSide(&mesh, x, y, -1, 0, 1, tile);
+                MeshAddMazeSide(&mesh, x, y, 0, 1, 1, tile);
+                MeshAddMazeSide(&mesh, x, y, 0, -1, 1, tile);
+            }
+            else MeshAddQuad(&mesh, (Vector3){ (float)x, 0.0f, (float)y }, (Vector3){ 1.0f, 0.0f, 0.0f }, (Vector3){ 0.0f, 0.0f, 1.0f }, (Vector3){ 0.0f, 1.0f, 0.0f }, tile);
+        }
+    }
+
+    ShrinkMazeMesh(&mesh);
+
+    return mesh;
+}
+
+// Get full maze mesh vertex/triangle counts and build times, greedy vs naive (CPU only)
+// NOTE: Both meshes are built per chunk, as used by the maze model, build time is averaged
+static MazeMeshStats GetMazeMeshStats(Image imMaze)
+{
+    MazeMeshStats stats = { 0 };
+
+    for (int method = 0; method < 2; method++)
+    {
+        int vertexCount = 0;
+        int triangleCount = 0;
+        clock_t start = clock();
+
+        for (int n = 0; n < MAZE_STATS_ITERATIONS; n++)
+        {
+            vertexCount = 0;
+            triangleCount = 0;
+
+            for (int y = 0; y < imMaze.height; y += MAZE_CHUNK_SIZE)
+            {
+                for (int x = 0; x < imMaze.width; x += MAZE_CHUNK_SIZE)
+                {
+                    int width = ((imMaze.width - x) < MAZE_CHUNK_SIZE)? (imMaze.width - x) : MAZE_CHUNK_SIZE;
+                    int height = ((imMaze.height - y) < MAZE_CHUNK_SIZE)? (imMaze.height - y) : MAZE_CHUNK_SIZE;
+
+                    Mesh mesh = (method == 0)? GenMeshMazeGreedy(imMaze, x, y, width, height) : GenMeshMazeNaive(imMaze, x, y, width, height);
+                    vertexCount += mesh.vertexCount;
+                    triangleCount += mesh.triangleCount;
+                    UnloadMazeMeshData(mesh);
+                }
+            }
+        }
+
+        double buildTime = (double)(clock() - start)*1000.0/CLOCKS_PER_SEC/MAZE_STATS_ITERATIONS;
+
+        if (method == 0)
+        {
+            stats.greedyVertexCount = vertexCount;
+            stats.greedyTriangleCount = triangleCount;
+            stats.greedyBuildTime = buildTime;
+        }
+        else
+        {
+            stats.naiveVertexCount = vertexCount;
+            stats.naiveTriangleCount = triangleCount;
+            stats.naiveBuildTime = buildTime;
+        }
+    }
+
+    TraceLog(LOG_INFO, "MAZE: Greedy mesh: %i vertices, %i triangles, %.3f ms", stats.greedyVertexCount, stats.greedyTriangleCount, stats.greedyBuildTime);
+    TraceLog(LOG_INFO, "MAZE: Naive mesh:  %i vertices, %i triangles, %.3f ms", stats.naiveVertexCount, stats.naiveTriangleCount, stats.naiveBuildTime);
+
+    return stats;
+}
+
+// Rebuild one maze model chunk mesh and upload it to GPU
+static void ReloadMazeChunk(Mesh *chunks, Image imMaze, int chunkX, int chunkY)
+{
+    int index = chunkY*MAZE_CHUNKS_X + chunkX;
+    int x = chunkX*MAZE_CHUNK_SIZE;
+    int y = chunkY*MAZE_CHUNK_SIZE;
+    int width = ((imMaze.width - x) < MAZE_CHUNK_SIZE)? (imMaze.width - x) : MAZE_CHUNK_SIZE;
+    int height = ((imMaze.height - y) < MAZE_CHUNK_SIZE)? (imMaze.height - y) : MAZE_CHUNK_SIZE;
+
+    if (chunks[index].vertices != NULL) UnloadMesh(chunks[index]);
+
+    chunks[index] = GenMeshMazeGreedy(imMaze, x, y, width, height);
+    if (chunks[index].vertexCount > 0) UploadMesh(&chunks[index], false);
+}
+
+// Rebuild maze model chunk meshes affected by an edited cell
+// NOTE: Cells on a chunk border also change the side faces of the neighbour chunk
+static void UpdateMazeChunks(Mesh *chunks, Image imMaze, int cellX, int cellY)
+{
+    int chunkX = cellX/MAZE_CHUNK_SIZE;
+    int chunkY = cellY/MAZE_CHUNK_SIZE;
+
+    ReloadMazeChunk(chunks, imMaze, chunkX, chunkY);
+
+    if (((cellX%MAZE_CHUNK_SIZE) == 0) && (chunkX > 0)) ReloadMazeChunk(chunks, imMaze, chunkX - 1, chunkY);
+    if (((cellX%MAZE_CHUNK_SIZE) == (MAZE_CHUNK_SIZE - 1)) && (chunkX < (MAZE_CHUNKS_X - 1))) ReloadMazeChunk(chunks, imMaze, chunkX + 1, chunkY);
+    if (((cellY%MAZE_CHUNK_SIZE) == 0) && (chunkY > 0)) ReloadMazeChunk(chunks, imMaze, chunkX, chunkY - 1);
+    if (((cellY%MAZE_CHUNK_SIZE) == (MAZE_CHUNK_SIZE - 1)) && (chunkY < (MAZE_CHUNKS_Y - 1))) ReloadMazeChunk(chunks, imMaze, chunkX, chunkY + 1);
+}